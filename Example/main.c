@@ -7,6 +7,7 @@
 /* Includes ------------------------------------------------------------------*/
 #include "main.h"
 #include "ssd1306.h"
+#include "ssd1306_widgets.h"
 
 /* Private typedef -----------------------------------------------------------*/
 /* Private define ------------------------------------------------------------*/
@@ -39,11 +40,20 @@ int main(void)
   BSP_LED_Init(LED_GREEN);
   BSP_LED_Toggle(LED_GREEN);	//All ok!
   
-  ssd1306_write_string(&ssd1306Handle, "Temperatura 29 C");
+  ssd1306_write_string(&ssd1306Handle, "Temperatura    C");
+  
+  SSD1306_NumberTypeDef temperature;
+  SSD1306_BarTypeDef temperature_bar;
+  ssd1306_number_init(&temperature, 0, 72, 2);
+  ssd1306_bar_init(&temperature_bar, 1, 0, 102);
   
   while(1)
   {
+	int32_t value = 29;	//read your sensor here
 	
+	//Only changed columns are sent to the display
+	ssd1306_number_set(&ssd1306Handle, &temperature, value);
+	ssd1306_bar_set(&ssd1306Handle, &temperature_bar, value < 0 ? 0 : (value > 50 ? 50 : value), 50);
   }
   
 }
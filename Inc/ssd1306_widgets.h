@@ -0,0 +1,69 @@
+/**
+	****************************************************************************
+	* @brief		Definitions for ssd1306 retained widgets
+	****************************************************************************
+*/
+
+#ifndef __SSD1306_WIDGETS_H
+#define __SSD1306_WIDGETS_H		//Define to prevent recursive inclusion
+
+#include "ssd1306.h"
+
+/* Exported constants ------------------------------------------------------- */
+#define SSD1306_WIDGET_MAX_COLUMNS	128
+#define SSD1306_WIDGET_MAX_CHARS	21		//128 columns / 6 columns per character
+#define SSD1306_WIDGET_MERGE_GAP	10		//unchanged columns resent instead of moving the cursor again
+
+/*	@brief	Common part of every widget. A widget lives on a single page.
+ */
+typedef struct SSD1306_WidgetTypeDef {
+  uint8_t	page;		//page between 0 and 3 (or 0 and 7)
+  uint8_t	column;		//first column between 0 and 127
+  uint8_t	width;		//width in columns
+  uint8_t	drawn;		//0 until the widget has been rendered once
+} SSD1306_WidgetTypeDef;
+
+/*	@brief	Fixed width text
+ */
+typedef struct SSD1306_LabelTypeDef {
+  SSD1306_WidgetTypeDef	widget;
+  char	text[SSD1306_WIDGET_MAX_CHARS];	//last rendered text, padded with spaces
+} SSD1306_LabelTypeDef;
+
+/*	@brief	Fixed width, right aligned signed number
+ */
+typedef struct SSD1306_NumberTypeDef {
+  SSD1306_LabelTypeDef	label;
+  int32_t	value;		//last rendered value
+} SSD1306_NumberTypeDef;
+
+/*	@brief	Horizontal bar graph (gauge)
+ */
+typedef struct SSD1306_BarTypeDef {
+  SSD1306_WidgetTypeDef	widget;
+  uint8_t	filled;		//last rendered number of filled columns
+} SSD1306_BarTypeDef;
+
+/*	@brief	Sparkline chart, one sample per column scrolling from right to left
+ */
+typedef struct SSD1306_ChartTypeDef {
+  SSD1306_WidgetTypeDef	widget;
+  uint8_t	columns[SSD1306_WIDGET_MAX_COLUMNS];	//last rendered columns
+} SSD1306_ChartTypeDef;
+
+/* Exported functions ------------------------------------------------------- */
+void ssd1306_widget_invalidate(SSD1306_WidgetTypeDef*);
+
+void ssd1306_label_init(SSD1306_LabelTypeDef*, uint8_t, uint8_t, uint8_t);
+void ssd1306_label_set(SSD1306_HandleTypeDef*, SSD1306_LabelTypeDef*, const char*);
+
+void ssd1306_number_init(SSD1306_NumberTypeDef*, uint8_t, uint8_t, uint8_t);
+void ssd1306_number_set(SSD1306_HandleTypeDef*, SSD1306_NumberTypeDef*, int32_t);
+
+void ssd1306_bar_init(SSD1306_BarTypeDef*, uint8_t, uint8_t, uint8_t);
+void ssd1306_bar_set(SSD1306_HandleTypeDef*, SSD1306_BarTypeDef*, uint16_t, uint16_t);
+
+void ssd1306_chart_init(SSD1306_ChartTypeDef*, uint8_t, uint8_t, uint8_t);
+void ssd1306_chart_push(SSD1306_HandleTypeDef*, SSD1306_ChartTypeDef*, uint16_t, uint16_t);
+
+#endif
@@ -36,18 +36,19 @@ void ssd1306_send_data(SSD1306_HandleTypeDef *ssd1306Handle, uint8_t data)
 	@param1	A SSD1306 handle structure pointer
 	@param2	A array of data
 	@param3	Size of array
+	@note	A single control byte with Co = 0 is sent first, so all following bytes are stored in GDDRAM
 	@note	if I2C fails, Error_Handler function is called
 **/
 void ssd1306_send_multiple_data(SSD1306_HandleTypeDef *ssd1306Handle, uint8_t *pData, const uint8_t size)
 {
-  uint8_t array[size*2];	//NOTE: please allow VLA in compiler settings
+  uint8_t array[size+1];	//NOTE: please allow VLA in compiler settings
   
-  for(uint16_t i = 0, j = 0; i < size*2; i+= 2, ++j) {
-	array[i] = SSD1306_CONTROLBYTE_DATA;
-	array[i+1] = pData[j];
+  array[0] = SSD1306_CONTROLBYTE_DATA;
+  for(uint16_t i = 0; i < size; ++i) {
+	array[i+1] = pData[i];
   }
   
-  if(HAL_I2C_Master_Transmit(ssd1306Handle->i2cHandle, ssd1306Handle->slave_address<<1, array, size*2, 100) != HAL_OK) {
+  if(HAL_I2C_Master_Transmit(ssd1306Handle->i2cHandle, ssd1306Handle->slave_address<<1, array, size+1, 100) != HAL_OK) {
 	Error_Handler();
   }
 }
@@ -0,0 +1,274 @@
+#include "ssd1306_widgets.h"
+
+#include <string.h>
+
+#include "fonts.h"
+
+/*
+================================================================================
+							Private Functions
+================================================================================
+*/
+
+/*	@brief	Send to the driver only the columns that differ from the last rendered ones.
+	@param1	A SSD1306 handle structure pointer
+	@param2	A widget structure pointer
+	@param3	Columns rendered last time. Ignored if the widget was never drawn
+	@param4	Columns to render now
+	@note	Changed columns are grouped in windows. Two windows closer than
+			SSD1306_WIDGET_MERGE_GAP columns are merged in a single one: a column
+			costs 1 byte, while a new window costs three command transfers plus
+			the address and control byte of a new data transfer (about 11 bytes).
+**/
+static void ssd1306_widget_flush(SSD1306_HandleTypeDef *ssd1306Handle, SSD1306_WidgetTypeDef *widget, const uint8_t *old_columns, uint8_t *new_columns)
+{
+  uint8_t i = 0;
+  
+  while(i < widget->width) {
+	if(widget->drawn && old_columns[i] == new_columns[i]) {
+	  ++i;
+	  continue;
+	}
+	
+	uint8_t start = i;
+	uint8_t end = i+1;	//exclusive
+	for(++i; i < widget->width; ++i) {
+	  if(!widget->drawn || old_columns[i] != new_columns[i]) {
+		end = i+1;
+	  }
+	  else if(i - end >= SSD1306_WIDGET_MERGE_GAP) {
+		break;
+	  }
+	}
+	
+	ssd1306_set_cursor_position(ssd1306Handle, widget->page, widget->column+start);
+	ssd1306_send_multiple_data(ssd1306Handle, &new_columns[start], end-start);
+  }
+  
+  widget->drawn = 1;
+}
+
+/*	@brief	Convert a text into display columns.
+	@param1	Text of exactly length characters
+	@param2	Number of characters
+	@param3	Destination array of length*6 columns
+**/
+static void ssd1306_widget_render_text(const char *text, uint8_t length, uint8_t *columns)
+{
+  for(uint8_t c = 0; c < length; ++c) {
+	memcpy(&columns[c*6], font_table[text[c]-32], 6);
+  }
+}
+
+/*	@brief	Render a new text on a label, updating only the columns which changed.
+	@param3	Text of exactly label length characters
+**/
+static void ssd1306_label_update(SSD1306_HandleTypeDef *ssd1306Handle, SSD1306_LabelTypeDef *label, const char *text)
+{
+  uint8_t length = label->widget.width/6;
+  
+  if(label->widget.drawn && memcmp(label->text, text, length) == 0) {
+	return;
+  }
+  
+  uint8_t old_columns[label->widget.width];	//NOTE: please allow VLA in compiler settings
+  uint8_t new_columns[label->widget.width];
+  
+  ssd1306_widget_render_text(label->text, length, old_columns);
+  ssd1306_widget_render_text(text, length, new_columns);
+  ssd1306_widget_flush(ssd1306Handle, &label->widget, old_columns, new_columns);
+  
+  memcpy(label->text, text, length);
+}
+
+/*	@brief	Initialize the common part of a widget. The widget is kept inside the
+			screen, since the column pointer would wrap to the start of the page.
+	@param3	First column. Moved left if min_width columns do not fit before the right edge
+	@param4	Width in columns, clamped between min_width and the right edge of the screen
+	@param5	Minimum width in columns
+**/
+static void ssd1306_widget_init(SSD1306_WidgetTypeDef *widget, uint8_t page, uint8_t column, uint8_t width, uint8_t min_width)
+{
+  if(column > SSD1306_WIDGET_MAX_COLUMNS-min_width) {
+	column = SSD1306_WIDGET_MAX_COLUMNS-min_width;
+  }
+  
+  if(width < min_width) {
+	width = min_width;
+  }
+  else if(width > SSD1306_WIDGET_MAX_COLUMNS-column) {
+	width = SSD1306_WIDGET_MAX_COLUMNS-column;
+  }
+  
+  widget->page = page;
+  widget->column = column;
+  widget->width = width;
+  widget->drawn = 0;
+}
+
+/*
+================================================================================
+							Widget Functions
+================================================================================
+*/
+
+/*	@brief	Force a full redraw on the next update, e.g. after ssd1306_clear_screen.
+	@param1	Pointer to the widget member of any widget structure
+**/
+void ssd1306_widget_invalidate(SSD1306_WidgetTypeDef *widget)
+{
+  widget->drawn = 0;
+}
+
+/* Label ******************************************************************** */
+/*	@brief	Initialize a label. Nothing is drawn until the first ssd1306_label_set.
+	@param2	Page between 0 and 3 (or 0 and 7)
+	@param3	Column between 0 and 127. Moved left to 122 if not even one character fits
+	@param4	Number of characters, clamped between 1 and the characters fitting before the right edge
+**/
+void ssd1306_label_init(SSD1306_LabelTypeDef *label, uint8_t page, uint8_t column, uint8_t length)
+{
+  if(column > SSD1306_WIDGET_MAX_COLUMNS-6) {
+	column = SSD1306_WIDGET_MAX_COLUMNS-6;
+  }
+  
+  if(length < 1) {
+	length = 1;
+  }
+  else if(length > (SSD1306_WIDGET_MAX_COLUMNS-column)/6) {
+	length = (SSD1306_WIDGET_MAX_COLUMNS-column)/6;
+  }
+  
+  ssd1306_widget_init(&label->widget, page, column, length*6, 6);
+  memset(label->text, ' ', sizeof(label->text));
+}
+
+/*	@brief	Change the text of a label. Only changed glyph columns are sent.
+	@param3	A string. It is truncated or padded with spaces to the label length
+**/
+void ssd1306_label_set(SSD1306_HandleTypeDef *ssd1306Handle, SSD1306_LabelTypeDef *label, const char *str)
+{
+  char text[SSD1306_WIDGET_MAX_CHARS];
+  uint8_t length = label->widget.width/6;
+  
+  for(uint8_t c = 0; c < length; ++c) {
+	text[c] = *str ? *(str++) : ' ';
+  }
+  
+  ssd1306_label_update(ssd1306Handle, label, text);
+}
+
+/* Number ******************************************************************* */
+/*	@brief	Initialize a numeric field. Nothing is drawn until the first ssd1306_number_set.
+	@param3	Column between 0 and 127. Moved left to 122 if not even one character fits
+	@param4	Number of characters, sign included, clamped between 1 and the characters fitting before the right edge
+**/
+void ssd1306_number_init(SSD1306_NumberTypeDef *number, uint8_t page, uint8_t column, uint8_t length)
+{
+  ssd1306_label_init(&number->label, page, column, length);
+  number->value = 0;
+}
+
+/*	@brief	Show a number right aligned. Nothing is sent if the value did not change.
+	@param3	The value to show
+	@note	If the value does not fit, the field is filled with '#'
+**/
+void ssd1306_number_set(SSD1306_HandleTypeDef *ssd1306Handle, SSD1306_NumberTypeDef *number, int32_t value)
+{
+  if(number->label.widget.drawn && number->value == value) {
+	return;
+  }
+  
+  char text[SSD1306_WIDGET_MAX_CHARS];
+  uint8_t length = number->label.widget.width/6;
+  uint32_t magnitude = value < 0 ? -(uint32_t)value : (uint32_t)value;
+  int8_t c = length-1;
+  
+  memset(text, ' ', length);
+  do {
+	text[c--] = '0' + magnitude%10;
+	magnitude /= 10;
+  } while(magnitude && c >= 0);
+  
+  if(value < 0 && c >= 0) {
+	text[c--] = '-';
+  }
+  else if(value < 0) {
+	magnitude = 1;	//no room left for the sign
+  }
+  
+  if(magnitude) {
+	memset(text, '#', length);
+  }
+  
+  ssd1306_label_update(ssd1306Handle, &number->label, text);
+  number->value = value;
+}
+
+/* Bar ********************************************************************** */
+/*	@brief	Initialize a horizontal bar. Nothing is drawn until the first ssd1306_bar_set.
+	@param3	Column between 0 and 127. Moved left to 125 if 3 columns do not fit
+	@param4	Width in columns, borders included. Clamped between 3 and the right edge of the screen
+**/
+void ssd1306_bar_init(SSD1306_BarTypeDef *bar, uint8_t page, uint8_t column, uint8_t width)
+{
+  ssd1306_widget_init(&bar->widget, page, column, width, 3);
+  bar->filled = 0;
+}
+
+/*	@brief	Fill the bar proportionally to value/max. Only the segment between the
+			old and the new level is sent.
+	@param3	Current value. Values above max are clamped
+	@param4	Full scale value. If 0, the bar is empty
+**/
+void ssd1306_bar_set(SSD1306_HandleTypeDef *ssd1306Handle, SSD1306_BarTypeDef *bar, uint16_t value, uint16_t max)
+{
+  uint8_t inner = bar->widget.width-2;
+  uint8_t filled = max ? (uint32_t)(value > max ? max : value)*inner/max : 0;
+  
+  if(bar->widget.drawn && bar->filled == filled) {
+	return;
+  }
+  
+  uint8_t old_columns[bar->widget.width];	//NOTE: please allow VLA in compiler settings
+  uint8_t new_columns[bar->widget.width];
+  
+  for(uint8_t i = 0; i < bar->widget.width; ++i) {
+	uint8_t border = (i == 0 || i == inner+1);
+	old_columns[i] = (border || i <= bar->filled) ? 0x7E : 0x42;
+	new_columns[i] = (border || i <= filled) ? 0x7E : 0x42;
+  }
+  
+  ssd1306_widget_flush(ssd1306Handle, &bar->widget, old_columns, new_columns);
+  bar->filled = filled;
+}
+
+/* Chart ******************************************************************** */
+/*	@brief	Initialize a sparkline chart. Nothing is drawn until the first ssd1306_chart_push.
+	@param3	Column between 0 and 127. Values above 127 are clamped to 127
+	@param4	Width in columns, i.e. number of samples shown. Clamped between 1 and the right edge of the screen
+**/
+void ssd1306_chart_init(SSD1306_ChartTypeDef *chart, uint8_t page, uint8_t column, uint8_t width)
+{
+  ssd1306_widget_init(&chart->widget, page, column, width, 1);
+  memset(chart->columns, 0x00, sizeof(chart->columns));
+}
+
+/*	@brief	Append a sample on the right and scroll the older ones to the left.
+			Only columns whose dot moved are sent.
+	@param3	Sample value. Values above max are clamped
+	@param4	Full scale value. If 0, the sample is drawn on the bottom row
+	@note	A sample is drawn as a single dot on one of the 8 rows of the page
+**/
+void ssd1306_chart_push(SSD1306_HandleTypeDef *ssd1306Handle, SSD1306_ChartTypeDef *chart, uint16_t value, uint16_t max)
+{
+  uint8_t width = chart->widget.width;
+  uint8_t row = max ? (uint32_t)(value > max ? max : value)*7/max : 0;
+  uint8_t old_columns[width];	//NOTE: please allow VLA in compiler settings
+  
+  memcpy(old_columns, chart->columns, width);
+  memmove(chart->columns, &chart->columns[1], width-1);
+  chart->columns[width-1] = 0x80>>row;	//bit 7 is the bottom row
+  
+  ssd1306_widget_flush(ssd1306Handle, &chart->widget, old_columns, chart->columns);
+}